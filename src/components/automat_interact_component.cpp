@@ -60,8 +60,12 @@ Automat GenerateAutomat(const std::string& prefix, uint32_t count = 2) {
                        random_signal(generator))}});
     }
   }
-  result.transition_function = [mapper](ControlPair in) mutable -> ControlPair {
-    return mapper[in];
+  // Автомат читают без блокировок из многих потоков, поэтому таблицу
+  // только ищем и никогда не изменяем
+  result.transition_function = [mapper](ControlPair in) -> ControlPair {
+    auto it = mapper.find(in);
+    if (it == mapper.end()) return {};
+    return it->second;
   };
   return result;
 }
@@ -82,29 +86,6 @@ std::string AutomatDiagram(const Automat& automat) {
 }
 }  // namespace
 
-namespace interact_component::routes {
-const std::string kEmpty{""};
-const std::string kGenerate{"generate"};
-const std::string kRegenerate = "regenerate";
-const std::string kCompare = "compare";
-}  // namespace interact_component::routes
-
-namespace interact_component::states {
-const State Idle{"Idle"};
-const State FirstAutomat{"FirstAutomat"};
-const State SecondAutomat{"SecondAutomat"};
-const State Comparison{"Comparison"};
-const State Error{"Error"};
-}  // namespace interact_component::states
-
-namespace interact_component::signals {
-const Signal Idle{"Idle"};
-const Signal FirstAutomat{"FirstAutomat"};
-const Signal SecondAutomat{"SecondAutomat"};
-const Signal Comparison{"Comparison"};
-const Signal Error{"Error"};
-}  // namespace interact_component::signals
-
 namespace interact_component::screens {
 
 const std::string kTemplate = R"(
@@ -143,7 +124,10 @@ const std::string MakeIdleScreen() {
         </div>)");
 }
 
-std::string MakeComparitionScreen(Automat automat1, Automat automat2) {
+std::string MakeComparitionScreen(const ComparableAutomat& comparable1,
+                                  const ComparableAutomat& comparable2) {
+  const Automat& automat1 = comparable1.Source();
+  const Automat& automat2 = comparable2.Source();
   const std::string top_header = "<h1>Comparison of automatons</h1><br>";
   const std::string summ_header = "<h3>Step 1: Multiply</h3><br>";
   std::string summ_content = AutomatDiagram(automat1 * automat2);
@@ -152,20 +136,20 @@ std::string MakeComparitionScreen(Automat automat1, Automat automat2) {
   const std::string cmp_header = "<h3>Step 3: Compare</h3><br>";
   std::string cmp_content =
       std::string("<h4>Automatons are ") +
-      ((automat1 == automat2) ? "Equal!</h4>" : "Unequal!</h4>");
+      ((comparable1 == comparable2) ? "Equal!</h4>" : "Unequal!</h4>");
 
   return fmt::format(kTemplate, top_header + summ_header + summ_content +
                                     trim_header + trim_content + cmp_header +
                                     cmp_content);
 }
 
-std::string MakeFirstAutomatScreen(Automat automat) {
+std::string MakeFirstAutomatScreen(const Automat& automat) {
   const std::string header = "<h1>Automat 1</h1><br>";
   std::string content = AutomatDiagram(automat);
   return fmt::format(kTemplate, header + content);
 }
 
-std::string MakeSecondAutomatScreen(Automat automat) {
+std::string MakeSecondAutomatScreen(const Automat& automat) {
   const std::string header = "<h1>Automat 2</h1><br>";
   std::string content = AutomatDiagram(automat);
   return fmt::format(kTemplate, header + content);
@@ -177,96 +161,36 @@ std::string MakeErrorScreen() {
 
 }  // namespace interact_component::screens
 
-/*
-              +      + generate      + regenerate    + compare     + <other>
-Idle          | Idle | FirstAutomat  | Error         | Error       | Error
-FirstAutomat  | Idle | SecondAutomat | FirstAutomat  | Error       | Error
-SecondAutomat | Idle | Error         | SecondAutomat | Comparison  | Error
-Comparison    | Idle | Error         | Error         | Comparison | Error
-Error         | Idle | Error         | Error         | Error       | Error
-
-*/
-
 namespace components {
 using namespace interact_component;
 InteractComponent::InteractComponent(
     const userver::components::ComponentConfig& config,
     const userver::components::ComponentContext& context)
-    : userver::components::LoggableComponentBase(config, context) {
-  Automat self_controller{};
-  self_controller.initial_state = states::Idle;
-  self_controller.current_state = self_controller.initial_state;
-  self_controller.input_signals = {{routes::kCompare},
-                                   {routes::kEmpty},
-                                   {routes::kGenerate},
-                                   {routes::kRegenerate}};
-  self_controller.states = {states::Idle, states::FirstAutomat,
-                            states::SecondAutomat, states::Comparison,
-                            states::Error};
-  self_controller.output_signals = {signals::Idle, signals::FirstAutomat,
-                                    signals::SecondAutomat, signals::Comparison,
-                                    signals::Error};
-  self_controller.transition_function = [&](ControlPair in) -> ControlPair {
-    std::map<ControlPair, ControlPair> mapping = {
-        {{states::Idle, {routes::kEmpty}}, {states::Idle, signals::Idle}},
-        {{states::Idle, {routes::kGenerate}},
-         {states::FirstAutomat, signals::FirstAutomat}},
-
-        {{states::FirstAutomat, {routes::kEmpty}},
-         {states::Idle, signals::Idle}},
-        {{states::FirstAutomat, {routes::kRegenerate}},
-         {states::FirstAutomat, signals::FirstAutomat}},
-        {{states::FirstAutomat, {routes::kGenerate}},
-         {states::SecondAutomat, signals::SecondAutomat}},
-
-        {{states::SecondAutomat, {routes::kEmpty}},
-         {states::Idle, signals::Idle}},
-        {{states::SecondAutomat, {routes::kRegenerate}},
-         {states::SecondAutomat, signals::SecondAutomat}},
-        {{states::SecondAutomat, {routes::kCompare}},
-         {states::Comparison, signals::Comparison}},
-
-        {{states::Comparison, {routes::kEmpty}}, {states::Idle, signals::Idle}},
-
-        {{states::Error, {routes::kEmpty}}, {states::Idle, signals::Idle}},
-    };
-    if (mapping.contains(in)) {
-      return mapping[in];
-    }
-    return {states::Error, signals::Error};
-  };
-  controller = std::move(self_controller);
-}
-
-Signal InteractComponent::Process(Signal in) {
-  auto [state, signal] =
-      controller.transition_function({*controller.current_state, in});
-  controller.current_state = state;
-  return signal;
-}
-
-std::string InteractComponent::MakeScreen(Signal in) {
-  if (in == signals::Idle) {
+    : userver::components::LoggableComponentBase(config, context),
+      state{MakeController(),
+            {{signals::FirstAutomat,
+              [](ComparedAutomats& automats) {
+                automats.first = ComparableAutomat(GenerateAutomat("q", 3));
+              }},
+             {signals::SecondAutomat, [](ComparedAutomats& automats) {
+                automats.second = ComparableAutomat(GenerateAutomat("S", 2));
+              }}}} {}
+
+std::string InteractComponent::Handle(Signal in) {
+  // Экран строится по снимку этого перехода уже без блокировок
+  const auto [signal, automats] = state.Process(in);
+  if (signal == signals::Idle) {
     return screens::MakeIdleScreen();
   }
-  if (in == signals::Comparison) {
-    return screens::MakeComparitionScreen(automat1, automat2);
+  if (signal == signals::Comparison) {
+    return screens::MakeComparitionScreen(automats->first, automats->second);
   }
-  if (in == signals::FirstAutomat) {
-    UpdateFirstAutomat();
-    return screens::MakeFirstAutomatScreen(automat1);
+  if (signal == signals::FirstAutomat) {
+    return screens::MakeFirstAutomatScreen(automats->first.Source());
   }
-  if (in == signals::SecondAutomat) {
-    UpdateSecondAutomat();
-    return screens::MakeSecondAutomatScreen(automat2);
+  if (signal == signals::SecondAutomat) {
+    return screens::MakeSecondAutomatScreen(automats->second.Source());
   }
   return screens::MakeErrorScreen();
 }
-
-void InteractComponent::UpdateSecondAutomat() {
-  automat2 = GenerateAutomat("S", 2);
-}
-void InteractComponent::UpdateFirstAutomat() {
-  automat1 = GenerateAutomat("q", 3);
-}
 }  // namespace components
\ No newline at end of file
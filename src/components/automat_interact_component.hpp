@@ -5,6 +5,7 @@
 #include <userver/components/loggable_component_base.hpp>
 
 #include "../models/automat.hpp"
+#include "interact_state.hpp"
 
 namespace components {
 class InteractComponent : public userver::components::LoggableComponentBase {
@@ -13,15 +14,10 @@ class InteractComponent : public userver::components::LoggableComponentBase {
                     const userver::components::ComponentContext& context);
   static constexpr std::string_view kName = "interact-machine";
 
-  Signal Process(Signal in);
-  std::string MakeScreen(Signal in);
+  // Выполняет переход по сигналу и строит экран для его результата
+  std::string Handle(Signal in);
 
  private:
-  void UpdateSecondAutomat();
-  void UpdateFirstAutomat();
-
-  Automat controller;
-  Automat automat1;
-  Automat automat2;
+  InteractState state;
 };
-}  // namespace components
\ No newline at end of file
+}  // namespace components
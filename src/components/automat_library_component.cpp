@@ -0,0 +1,30 @@
+#include "automat_library_component.hpp"
+#include <mutex>
+#include <shared_mutex>
+#include <userver/logging/log.hpp>
+
+namespace components {
+LibraryComponent::LibraryComponent(
+    const userver::components::ComponentConfig& config,
+    const userver::components::ComponentContext& context)
+    : userver::components::LoggableComponentBase(config, context) {}
+
+void LibraryComponent::Add(const std::string& id, const Automat& automat) {
+  // Минимизация идёт до блокировки, под ней только вставка в хеш-таблицы
+  AutomatIndex::Entry entry = AutomatIndex::MakeEntry(automat);
+  std::unique_lock lock(mutex);
+  index.Add(id, std::move(entry));
+  LOG_DEBUG() << "Library size " << index.Size();
+}
+
+bool LibraryComponent::Remove(const std::string& id) {
+  std::unique_lock lock(mutex);
+  return index.Remove(id);
+}
+
+std::vector<std::string> LibraryComponent::Find(const Automat& automat) const {
+  AutomatIndex::Entry entry = AutomatIndex::MakeEntry(automat);
+  std::shared_lock lock(mutex);
+  return index.Find(entry);
+}
+}  // namespace components
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/engine/shared_mutex.hpp>
+
+#include "../models/automat_index.hpp"
+
+namespace components {
+class LibraryComponent : public userver::components::LoggableComponentBase {
+ public:
+  LibraryComponent(const userver::components::ComponentConfig& config,
+                   const userver::components::ComponentContext& context);
+  static constexpr std::string_view kName = "automat-library";
+
+  void Add(const std::string& id, const Automat& automat);
+  bool Remove(const std::string& id);
+  std::vector<std::string> Find(const Automat& automat) const;
+
+ private:
+  mutable userver::engine::SharedMutex mutex;
+  AutomatIndex index;
+};
+}  // namespace components
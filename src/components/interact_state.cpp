@@ -0,0 +1,106 @@
+#include "interact_state.hpp"
+#include <mutex>
+
+namespace interact_component::routes {
+const std::string kEmpty{""};
+const std::string kGenerate{"generate"};
+const std::string kRegenerate = "regenerate";
+const std::string kCompare = "compare";
+}  // namespace interact_component::routes
+
+namespace interact_component::states {
+const State Idle{"Idle"};
+const State FirstAutomat{"FirstAutomat"};
+const State SecondAutomat{"SecondAutomat"};
+const State Comparison{"Comparison"};
+const State Error{"Error"};
+}  // namespace interact_component::states
+
+namespace interact_component::signals {
+const Signal Idle{"Idle"};
+const Signal FirstAutomat{"FirstAutomat"};
+const Signal SecondAutomat{"SecondAutomat"};
+const Signal Comparison{"Comparison"};
+const Signal Error{"Error"};
+}  // namespace interact_component::signals
+
+/*
+              +      + generate      + regenerate    + compare     + <other>
+Idle          | Idle | FirstAutomat  | Error         | Error       | Error
+FirstAutomat  | Idle | SecondAutomat | FirstAutomat  | Error       | Error
+SecondAutomat | Idle | Error         | SecondAutomat | Comparison  | Error
+Comparison    | Idle | Error         | Error         | Comparison | Error
+Error         | Idle | Error         | Error         | Error       | Error
+
+*/
+
+namespace interact_component {
+Automat MakeController() {
+  Automat self_controller{};
+  self_controller.initial_state = states::Idle;
+  self_controller.input_signals = {{routes::kCompare},
+                                   {routes::kEmpty},
+                                   {routes::kGenerate},
+                                   {routes::kRegenerate}};
+  self_controller.states = {states::Idle, states::FirstAutomat,
+                            states::SecondAutomat, states::Comparison,
+                            states::Error};
+  self_controller.output_signals = {signals::Idle, signals::FirstAutomat,
+                                    signals::SecondAutomat, signals::Comparison,
+                                    signals::Error};
+  self_controller.transition_function = [](ControlPair in) -> ControlPair {
+    std::map<ControlPair, ControlPair> mapping = {
+        {{states::Idle, {routes::kEmpty}}, {states::Idle, signals::Idle}},
+        {{states::Idle, {routes::kGenerate}},
+         {states::FirstAutomat, signals::FirstAutomat}},
+
+        {{states::FirstAutomat, {routes::kEmpty}},
+         {states::Idle, signals::Idle}},
+        {{states::FirstAutomat, {routes::kRegenerate}},
+         {states::FirstAutomat, signals::FirstAutomat}},
+        {{states::FirstAutomat, {routes::kGenerate}},
+         {states::SecondAutomat, signals::SecondAutomat}},
+
+        {{states::SecondAutomat, {routes::kEmpty}},
+         {states::Idle, signals::Idle}},
+        {{states::SecondAutomat, {routes::kRegenerate}},
+         {states::SecondAutomat, signals::SecondAutomat}},
+        {{states::SecondAutomat, {routes::kCompare}},
+         {states::Comparison, signals::Comparison}},
+
+        {{states::Comparison, {routes::kEmpty}}, {states::Idle, signals::Idle}},
+
+        {{states::Error, {routes::kEmpty}}, {states::Idle, signals::Idle}},
+    };
+    if (mapping.contains(in)) {
+      return mapping[in];
+    }
+    return {states::Error, signals::Error};
+  };
+  return self_controller;
+}
+}  // namespace interact_component
+
+namespace components {
+InteractState::InteractState(Automat controller,
+                             std::map<Signal, Update> updates)
+    : controller{std::move(controller)},
+      updates{std::move(updates)},
+      current_state{this->controller.initial_state} {}
+
+InteractState::Step InteractState::Process(const Signal& in) {
+  std::lock_guard lock(mutex);
+  auto [next_state, signal] =
+      controller.transition_function({current_state, in});
+  current_state = std::move(next_state);
+
+  auto update = updates.find(signal);
+  if (update != updates.end()) {
+    auto writable = automats.StartWrite();
+    update->second(*writable);
+    writable.Commit();
+  }
+  // Все писатели держат мьютекс, поэтому это снимок именно этого перехода
+  return {std::move(signal), automats.Read()};
+}
+}  // namespace components
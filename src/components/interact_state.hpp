@@ -0,0 +1,78 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/rcu/rcu.hpp>
+
+#include "../models/automat.hpp"
+#include "../models/comparable_automat.hpp"
+
+namespace interact_component::routes {
+extern const std::string kEmpty;
+extern const std::string kGenerate;
+extern const std::string kRegenerate;
+extern const std::string kCompare;
+}  // namespace interact_component::routes
+
+namespace interact_component::states {
+extern const State Idle;
+extern const State FirstAutomat;
+extern const State SecondAutomat;
+extern const State Comparison;
+extern const State Error;
+}  // namespace interact_component::states
+
+namespace interact_component::signals {
+extern const Signal Idle;
+extern const Signal FirstAutomat;
+extern const Signal SecondAutomat;
+extern const Signal Comparison;
+extern const Signal Error;
+}  // namespace interact_component::signals
+
+namespace interact_component {
+// Автомат переходов между экранами
+Automat MakeController();
+}  // namespace interact_component
+
+namespace components {
+// Неизменяемый снимок пары сравниваемых автоматов
+struct ComparedAutomats {
+  ComparableAutomat first;
+  ComparableAutomat second;
+};
+
+// Состояние экранов и сравниваемые автоматы. Переход и вызванное им
+// обновление автоматов выполняются в одной критической секции, поэтому
+// любой, кто увидел состояние, видит и автоматы, которые оно подразумевает.
+// Сравнение идёт уже без блокировок по снимку из rcu::Variable.
+class InteractState {
+ public:
+  using Snapshot = userver::rcu::ReadablePtr<ComparedAutomats>;
+  // Обновление снимка для выходного сигнала контроллера
+  using Update = std::function<void(ComparedAutomats&)>;
+
+  struct Step {
+    Signal signal;
+    // Снимок сразу после перехода, включая обновление этого запроса
+    Snapshot automats;
+  };
+
+  InteractState(Automat controller, std::map<Signal, Update> updates);
+
+  Step Process(const Signal& in);
+  Snapshot Read() const { return automats.Read(); }
+
+ private:
+  const Automat controller;
+  const std::map<Signal, Update> updates;
+
+  // Состояние меняет каждый запрос, поэтому мьютекс, а не rcu
+  userver::engine::Mutex mutex;
+  State current_state;
+  userver::rcu::Variable<ComparedAutomats> automats;
+};
+}  // namespace components
@@ -0,0 +1,51 @@
+#include "interact_state.hpp"
+#include <atomic>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+
+#include "interact_state_test_utils.hpp"
+
+using namespace interact_component;
+
+// Время сравнения по снимку в одном потоке, пока ещё range(0) - 1 потоков
+// читают тот же снимок, а писатель постоянно заменяет первый автомат.
+// При линейном масштабировании время не растёт с числом потоков.
+void InteractStateRead(benchmark::State& state) {
+  const auto threads = static_cast<std::size_t>(state.range(0));
+  userver::engine::RunStandalone(threads + 1, [&] {
+    auto interact = interact_testing::MakeState();
+    interact.Process({routes::kGenerate});
+    interact.Process({routes::kGenerate});
+
+    std::atomic<bool> stop{false};
+    std::vector<userver::engine::TaskWithResult<void>> tasks;
+    tasks.push_back(userver::engine::AsyncNoSpan([&] {
+      interact.Process({routes::kEmpty});
+      interact.Process({routes::kGenerate});
+      while (!stop) {
+        interact.Process({routes::kRegenerate});
+        userver::engine::Yield();
+      }
+    }));
+    for (std::size_t i = 1; i < threads; ++i) {
+      tasks.push_back(userver::engine::AsyncNoSpan([&] {
+        while (!stop) {
+          auto snapshot = interact.Read();
+          benchmark::DoNotOptimize(snapshot->first == snapshot->second);
+        }
+      }));
+    }
+
+    for (auto _ : state) {
+      auto snapshot = interact.Read();
+      benchmark::DoNotOptimize(snapshot->first == snapshot->second);
+    }
+    stop = true;
+    for (auto& task : tasks) task.Get();
+  });
+}
+BENCHMARK(InteractStateRead)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
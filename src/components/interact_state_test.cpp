@@ -0,0 +1,61 @@
+#include "interact_state.hpp"
+#include <atomic>
+#include <random>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+#include "interact_state_test_utils.hpp"
+
+using namespace interact_component;
+using interact_testing::MakeState;
+
+UTEST(InteractState, Sequence) {
+  auto state = MakeState();
+  EXPECT_EQ(state.Process({routes::kGenerate}).signal, signals::FirstAutomat);
+  EXPECT_EQ(state.Process({routes::kCompare}).signal, signals::Error);
+  EXPECT_EQ(state.Process({routes::kEmpty}).signal, signals::Idle);
+  state.Process({routes::kGenerate});
+  state.Process({routes::kGenerate});
+  auto step = state.Process({routes::kCompare});
+  ASSERT_EQ(step.signal, signals::Comparison);
+  EXPECT_TRUE(step.automats->first == step.automats->second);
+}
+
+// Запросы с разными сигналами идут параллельно. Каждый, кто попал в
+// Comparison, должен видеть оба сгенерированных автомата, иначе
+// сравнение бросит исключение на разных алфавитах.
+UTEST_MT(InteractState, ConcurrentSignals, 4) {
+  auto state = MakeState();
+  const std::vector<Signal> inputs{{routes::kEmpty},
+                                   {routes::kGenerate},
+                                   {routes::kRegenerate},
+                                   {routes::kCompare}};
+  std::atomic<int> comparisons{0};
+
+  std::vector<userver::engine::TaskWithResult<void>> tasks;
+  for (int task = 0; task < 4; ++task) {
+    tasks.push_back(userver::engine::AsyncNoSpan([&, task] {
+      std::mt19937 generator(task);
+      for (int i = 0; i < 2000; ++i) {
+        auto step = state.Process(inputs[generator() % inputs.size()]);
+        if (step.signal != signals::Comparison) continue;
+        ASSERT_TRUE(step.automats->first.Source().transition_function);
+        ASSERT_TRUE(step.automats->second.Source().transition_function);
+        EXPECT_TRUE(step.automats->first == step.automats->second);
+        ++comparisons;
+      }
+    }));
+  }
+  // Читатели без блокировок рядом с писателями
+  for (int i = 0; i < 2000; ++i) {
+    auto snapshot = state.Read();
+    if (snapshot->first.Source().transition_function &&
+        snapshot->second.Source().transition_function) {
+      EXPECT_TRUE(snapshot->first == snapshot->second);
+    }
+  }
+  for (auto& task : tasks) task.Get();
+  EXPECT_GT(comparisons.load(), 0);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../models/automat_test_utils.hpp"
+#include "interact_state.hpp"
+
+namespace interact_testing {
+
+// Настоящий контроллер экранов с детерминированными автоматами вместо
+// случайных: первый и второй всегда эквивалентные переключатели
+inline components::InteractState MakeState() {
+  using namespace interact_component;
+  using automat_testing::MakeToggle;
+  return {MakeController(),
+          {{signals::FirstAutomat,
+            [](components::ComparedAutomats& automats) {
+              automats.first = ComparableAutomat(MakeToggle("q"));
+            }},
+           {signals::SecondAutomat,
+            [](components::ComparedAutomats& automats) {
+              automats.second = ComparableAutomat(MakeToggle("S"));
+            }}}};
+}
+
+}  // namespace interact_testing
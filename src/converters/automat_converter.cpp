@@ -29,17 +29,22 @@ Automat Parse(const formats::json::Value& json, formats::parse::To<Automat>) {
   automat.states = json["state"].As<std::set<State>>();
   automat.output_signals = json["output_signals"].As<std::set<Signal>>();
   automat.input_signals = json["input_signals"].As<std::set<Signal>>();
-  automat.transition_function = [json](ControlPair cp) -> ControlPair {
-    std::unordered_map<
-        std::string, std::unordered_map<std::string,
-                                  std::unordered_map<std::string, std::string>>>
-        table = json["transition_function"]
-                    .As<std::unordered_map<
-                        std::string, std::unordered_map<
-                                   std::string, std::unordered_map<std::string,
-                                                              std::string>>>>();
-    return {table[cp.first.id][cp.second.id]["state"],
-            table[cp.first.id][cp.second.id]["signal"]};
+  // Таблицу разбираем один раз, а не при каждом вызове transition_function
+  using Table = std::unordered_map<
+      std::string,
+      std::unordered_map<std::string,
+                         std::unordered_map<std::string, std::string>>>;
+  automat.transition_function =
+      [table = json["transition_function"].As<Table>()](
+          ControlPair cp) -> ControlPair {
+    auto row = table.find(cp.first.id);
+    if (row == table.end()) return {};
+    auto cell = row->second.find(cp.second.id);
+    if (cell == row->second.end()) return {};
+    auto state = cell->second.find("state");
+    auto signal = cell->second.find("signal");
+    if (state == cell->second.end() || signal == cell->second.end()) return {};
+    return {state->second, signal->second};
   };
   return automat;
 }
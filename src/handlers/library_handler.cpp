@@ -0,0 +1,59 @@
+#include "library_handler.hpp"
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/logging/log.hpp>
+
+#include "../converters/automat_converter.hpp"
+
+namespace handlers {
+LibraryHandler::LibraryHandler(
+    const userver::components::ComponentConfig& config,
+    const userver::components::ComponentContext& context)
+    : userver::server::handlers::HttpHandlerBase(config, context),
+      library_(context.FindComponent<components::LibraryComponent>(
+          "automat-library")) {}
+
+std::string LibraryHandler::HandleRequestThrow(
+    const userver::server::http::HttpRequest& request,
+    userver::server::request::RequestContext&) const {
+  using userver::server::http::HttpMethod;
+  using userver::server::http::HttpStatus;
+  request.GetHttpResponse().SetContentType("application/json");
+  const std::string& id = request.GetArg("id");
+
+  try {
+    switch (request.GetMethod()) {
+      case HttpMethod::kPut: {
+        if (id.empty()) break;
+        library_.Add(id, formats::json::FromString(request.RequestBody())
+                             .As<Automat>());
+        return "{}";
+      }
+      case HttpMethod::kDelete: {
+        if (id.empty()) break;
+        if (!library_.Remove(id)) {
+          request.SetResponseStatus(HttpStatus::kNotFound);
+        }
+        return "{}";
+      }
+      case HttpMethod::kPost: {
+        auto ids = library_.Find(
+            formats::json::FromString(request.RequestBody()).As<Automat>());
+        formats::json::ValueBuilder builder;
+        builder["ids"] = ids;
+        return formats::json::ToString(builder.ExtractValue());
+      }
+      default:
+        break;
+    }
+  } catch (const AutomatException& exception) {
+    LOG_DEBUG() << "Invalid automat: " << exception.what();
+  } catch (const formats::json::Exception& exception) {
+    LOG_DEBUG() << "Invalid automat: " << exception.what();
+  }
+  request.SetResponseStatus(HttpStatus::kBadRequest);
+  return "{}";
+}
+}  // namespace handlers
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "../components/automat_library_component.hpp"
+
+#include <userver/components/component_list.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+
+namespace handlers {
+// PUT ?id=<id> с автоматом в теле добавляет его в библиотеку,
+// DELETE ?id=<id> удаляет, POST с автоматом в теле ищет эквивалентные
+class LibraryHandler final : public userver::server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-library";
+
+  using HttpHandlerBase::HttpHandlerBase;
+
+  LibraryHandler(const userver::components::ComponentConfig& config,
+                 const userver::components::ComponentContext& context);
+
+  std::string HandleRequestThrow(
+      const userver::server::http::HttpRequest& request,
+      userver::server::request::RequestContext&) const override;
+
+ private:
+  components::LibraryComponent& library_;
+};
+
+}  // namespace handlers
@@ -17,7 +17,6 @@ std::string SignalHandler::HandleRequestThrow(
   if(signal == "favicon.ico")
     return "404";
   LOG_DEBUG() << "Process signal " << signal;
-  Signal response_signal = controller_.Process(signal);
-  return controller_.MakeScreen(response_signal);
+  return controller_.Handle(signal);
 }
 }  // namespace handlers
\ No newline at end of file
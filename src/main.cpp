@@ -7,6 +7,8 @@
 #include <userver/utils/daemon_run.hpp>
 
 #include "components/automat_interact_component.hpp"
+#include "components/automat_library_component.hpp"
+#include "handlers/library_handler.hpp"
 #include "handlers/signal_handler.hpp"
 
 int main(int argc, char* argv[]) {
@@ -17,6 +19,8 @@ int main(int argc, char* argv[]) {
                             .Append<userver::clients::dns::Component>()
                             .Append<userver::server::handlers::TestsControl>()
                             .Append<components::InteractComponent>()
+                            .Append<components::LibraryComponent>()
+                            .Append<handlers::LibraryHandler>()
                             .Append<handlers::SignalHandler>();
 
   return userver::utils::DaemonMain(argc, argv, component_list);
@@ -1,10 +1,12 @@
 // automat.cpp
 #include "automat.hpp"
+#include "small_automat.hpp"
 #include <iomanip>
 #include <iostream>
 #include <queue>
 #include <vector>
 
+
 Signal::Signal(Signal signal1, Signal signal2) {
   id = signal1.id + '_' + signal2.id;
   source_signals.emplace_back(signal1);
@@ -124,6 +126,11 @@ std::ostream& operator<<(std::ostream& out, const Automat& Automat) {
 }
 
 bool operator==(const Automat& lhs, const Automat& rhs) {
+  // Маленькие автоматы сравниваем на стеке, без std::set и std::function
+  if (auto small_result = CompareSmall(lhs, rhs)) {
+    return *small_result;
+  }
+
   Automat merged = lhs * rhs;  // Получаем произведение автоматов
 
 #ifdef DEBUG
@@ -0,0 +1,83 @@
+// automat_index.cpp
+#include "automat_index.hpp"
+
+AutomatIndex::Entry AutomatIndex::MakeEntry(const Automat& automat) {
+  CanonicalAutomat canonical = Canonize(automat);
+  const std::size_t fingerprint = Fingerprint(canonical);
+  return {fingerprint, std::move(canonical), ComputeProbeSignature(automat)};
+}
+
+bool AutomatIndex::Matches(const Group& group, const Entry& entry) {
+  // У эквивалентных автоматов с одинаковыми алфавитами сигнатуры совпадают
+  if (group.signature && entry.signature &&
+      !(*group.signature == *entry.signature)) {
+    return false;
+  }
+  return group.canonical == entry.canonical;
+}
+
+void AutomatIndex::Add(const std::string& id, const Automat& automat) {
+  Add(id, MakeEntry(automat));
+}
+
+void AutomatIndex::Add(const std::string& id, Entry entry) {
+  Remove(id);
+
+  Group* group = nullptr;
+  auto [begin, end] = groups.equal_range(entry.fingerprint);
+  for (auto it = begin; it != end; ++it) {
+    // Совпадение хешей ещё не означает эквивалентность
+    if (Matches(it->second, entry)) {
+      group = &it->second;
+      break;
+    }
+  }
+  if (group == nullptr) {
+    group = &groups
+                 .emplace(entry.fingerprint,
+                          Group{entry.fingerprint, std::move(entry.canonical),
+                                entry.signature, {}})
+                 ->second;
+  }
+  group->ids.insert(id);
+  entries.emplace(id, group);
+}
+
+bool AutomatIndex::Remove(const std::string& id) {
+  auto entry = entries.find(id);
+  if (entry == entries.end()) return false;
+
+  Group* group = entry->second;
+  entries.erase(entry);
+  group->ids.erase(id);
+  if (!group->ids.empty()) return true;
+
+  // Пустую группу удаляем, других форм с тем же хешем почти никогда нет
+  auto [begin, end] = groups.equal_range(group->fingerprint);
+  for (auto it = begin; it != end; ++it) {
+    if (&it->second == group) {
+      groups.erase(it);
+      break;
+    }
+  }
+  return true;
+}
+
+std::vector<std::string> AutomatIndex::Find(const Automat& automat) const {
+  return Find(MakeEntry(automat));
+}
+
+std::vector<std::string> AutomatIndex::Find(const Entry& entry) const {
+  const auto* ids = Match(entry);
+  if (ids == nullptr) return {};
+  return {ids->begin(), ids->end()};
+}
+
+const std::unordered_set<std::string>* AutomatIndex::Match(
+    const Entry& entry) const {
+  auto [begin, end] = groups.equal_range(entry.fingerprint);
+  for (auto it = begin; it != end; ++it) {
+    if (Matches(it->second, entry)) return &it->second.ids;
+  }
+  return nullptr;
+}
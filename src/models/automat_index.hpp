@@ -0,0 +1,62 @@
+// automat_index.hpp
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "automat.hpp"
+#include "canonical_automat.hpp"
+#include "probe_signature.hpp"
+
+// Библиотека автоматов с поиском эквивалентных. Эквивалентные автоматы
+// собираются в одну группу по каноничной форме, группы индексируются её
+// хешем. Поиск делает одну точную проверку на каждую различную форму с тем
+// же хешем, а не на каждый id, поэтому не зависит от размера библиотеки.
+class AutomatIndex {
+ public:
+  struct Entry {
+    std::size_t fingerprint;
+    CanonicalAutomat canonical;
+    // Если у кандидата и запроса сигнатуры разные, каноничные формы
+    // не сравниваются
+    std::optional<ProbeSignature> signature;
+  };
+
+  // Минимизация, хеширование и сигнатура, не трогает сам индекс
+  static Entry MakeEntry(const Automat& automat);
+
+  // Добавляет автомат, заменяя сохранённый ранее под тем же id
+  void Add(const std::string& id, const Automat& automat);
+  void Add(const std::string& id, Entry entry);
+  // Возвращает false, если автомата с таким id нет
+  bool Remove(const std::string& id);
+  // id всех сохранённых автоматов, эквивалентных данному
+  std::vector<std::string> Find(const Automat& automat) const;
+  std::vector<std::string> Find(const Entry& entry) const;
+  // То же без копирования: id группы эквивалентных автоматов или nullptr.
+  // Указатель действителен до следующего изменения индекса.
+  const std::unordered_set<std::string>* Match(const Entry& entry) const;
+
+  std::size_t Size() const { return entries.size(); }
+  // Число различных каноничных форм
+  std::size_t GroupCount() const { return groups.size(); }
+
+ private:
+  struct Group {
+    std::size_t fingerprint;
+    CanonicalAutomat canonical;
+    std::optional<ProbeSignature> signature;
+    std::unordered_set<std::string> ids;
+  };
+
+  // Сравнение с группой: сначала сигнатуры, затем точная проверка
+  static bool Matches(const Group& group, const Entry& entry);
+
+  // Ссылки на элементы unordered-контейнеров не меняются при рехешировании
+  std::unordered_map<std::string, Group*> entries;
+  std::unordered_multimap<std::size_t, Group> groups;
+};
@@ -0,0 +1,126 @@
+#include "automat_index.hpp"
+#include "automat_test_utils.hpp"
+#include <algorithm>
+#include <map>
+
+#include <userver/utest/utest.hpp>
+
+namespace {
+
+using automat_testing::MakeAutomat;
+using automat_testing::MakeToggle;
+
+// Тот же автомат с дублирующим и недостижимым состояниями, начальное
+// состояние не первое по порядку имён
+Automat MakeRedundantToggle(const std::string& prefix) {
+  const State s0{prefix + "0"}, s1{prefix + "1"}, s2{prefix + "2"},
+      s3{prefix + "3"};
+  Automat result = MakeAutomat(prefix,
+                               {{{s1, {"a"}}, {s2, {"0"}}},
+                                {{s1, {"b"}}, {s0, {"0"}}},
+                                {{s2, {"a"}}, {s1, {"1"}}},
+                                {{s2, {"b"}}, {s1, {"1"}}},
+                                {{s0, {"a"}}, {s1, {"1"}}},
+                                {{s0, {"b"}}, {s1, {"1"}}},
+                                {{s3, {"a"}}, {s3, {"0"}}},
+                                {{s3, {"b"}}, {s3, {"0"}}}},
+                               4);
+  result.initial_state = s1;
+  return result;
+}
+
+// Всегда выдаёт 0
+Automat MakeConstant(const std::string& prefix) {
+  const State s0{prefix + "0"};
+  return MakeAutomat(
+      prefix, {{{s0, {"a"}}, {s0, {"0"}}}, {{s0, {"b"}}, {s0, {"0"}}}}, 1);
+}
+
+}  // namespace
+
+UTEST(CanonicalAutomat, Minimized) {
+  auto canonical = Canonize(MakeRedundantToggle("q"));
+  ASSERT_EQ(canonical.table.size(), 2);
+  EXPECT_EQ(canonical, Canonize(MakeToggle("S")));
+  EXPECT_EQ(Fingerprint(canonical), Fingerprint(Canonize(MakeToggle("S"))));
+  EXPECT_NE(canonical, Canonize(MakeConstant("S")));
+}
+
+UTEST(CanonicalAutomat, OutsideTransition) {
+  const State s0{"q0"};
+  auto automat = MakeAutomat(
+      "q", {{{s0, {"a"}}, {State("q7"), {"0"}}}, {{s0, {"b"}}, {s0, {"0"}}}},
+      1);
+  EXPECT_THROW(Canonize(automat), AutomatException);
+}
+
+UTEST(AutomatIndex, Find) {
+  AutomatIndex index;
+  index.Add("toggle", MakeToggle("q"));
+  index.Add("redundant", MakeRedundantToggle("r"));
+  index.Add("constant", MakeConstant("c"));
+  ASSERT_EQ(index.Size(), 3);
+
+  auto ids = index.Find(MakeToggle("S"));
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ(ids, (std::vector<std::string>{"redundant", "toggle"}));
+  EXPECT_EQ(index.Find(MakeConstant("S")),
+            std::vector<std::string>{"constant"});
+}
+
+UTEST(AutomatIndex, Update) {
+  AutomatIndex index;
+  index.Add("machine", MakeToggle("q"));
+  index.Add("machine", MakeConstant("q"));
+  EXPECT_EQ(index.Size(), 1);
+  EXPECT_TRUE(index.Find(MakeToggle("S")).empty());
+
+  EXPECT_TRUE(index.Remove("machine"));
+  EXPECT_FALSE(index.Remove("machine"));
+  EXPECT_TRUE(index.Find(MakeConstant("S")).empty());
+}
+
+UTEST(AutomatIndex, Groups) {
+  AutomatIndex index;
+  for (int i = 0; i < 100; ++i) {
+    index.Add("toggle" + std::to_string(i), MakeToggle("q"));
+    index.Add("redundant" + std::to_string(i), MakeRedundantToggle("r"));
+  }
+  index.Add("constant", MakeConstant("c"));
+  EXPECT_EQ(index.Size(), 201);
+  EXPECT_EQ(index.GroupCount(), 2);
+  EXPECT_EQ(index.Find(MakeToggle("S")).size(), 200);
+  const auto* ids = index.Match(AutomatIndex::MakeEntry(MakeToggle("S")));
+  ASSERT_NE(ids, nullptr);
+  EXPECT_EQ(ids->size(), 200);
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(index.Remove("toggle" + std::to_string(i)));
+  }
+  EXPECT_EQ(index.Find(MakeToggle("S")).size(), 100);
+  EXPECT_EQ(index.GroupCount(), 2);
+
+  EXPECT_TRUE(index.Remove("constant"));
+  EXPECT_EQ(index.GroupCount(), 1);
+  EXPECT_TRUE(index.Find(MakeConstant("S")).empty());
+}
+
+UTEST(AutomatIndex, SignaturePrefilter) {
+  // Искусственная коллизия хешей двух разных форм
+  auto toggle = AutomatIndex::MakeEntry(MakeToggle("q"));
+  auto constant = AutomatIndex::MakeEntry(MakeConstant("c"));
+  ASSERT_TRUE(toggle.signature.has_value());
+  ASSERT_TRUE(constant.signature.has_value());
+  toggle.fingerprint = constant.fingerprint = 42;
+
+  AutomatIndex index;
+  index.Add("toggle", toggle);
+  index.Add("constant", constant);
+  EXPECT_EQ(index.GroupCount(), 2);
+  EXPECT_EQ(index.Find(constant), std::vector<std::string>{"constant"});
+
+  // Разные сигнатуры отсекают группу без сравнения каноничных форм
+  auto mismatched = toggle;
+  mismatched.signature = constant.signature;
+  EXPECT_TRUE(index.Find(mismatched).empty());
+}
@@ -0,0 +1,42 @@
+// automat_test_utils.hpp
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "automat.hpp"
+
+// Общие автоматы для тестов и бенчмарков
+namespace automat_testing {
+
+// Автомат над входами {a, b} и выходами {0, 1} с состояниями
+// prefix0..prefix<count - 1> по таблице переходов
+inline Automat MakeAutomat(const std::string& prefix,
+                           std::map<ControlPair, ControlPair> table,
+                           uint32_t count) {
+  Automat result;
+  result.input_signals = {{"a"}, {"b"}};
+  result.output_signals = {{"0"}, {"1"}};
+  for (uint32_t i = 0; i < count; ++i) {
+    result.states.insert(State(prefix + std::to_string(i)));
+  }
+  result.initial_state = State(prefix + "0");
+  result.transition_function = [table](ControlPair in) mutable {
+    return table[in];
+  };
+  return result;
+}
+
+// Чередует выходы 0/1 на любой вход
+inline Automat MakeToggle(const std::string& prefix) {
+  const State s0{prefix + "0"}, s1{prefix + "1"};
+  return MakeAutomat(prefix,
+                     {{{s0, {"a"}}, {s1, {"0"}}},
+                      {{s0, {"b"}}, {s1, {"0"}}},
+                      {{s1, {"a"}}, {s0, {"1"}}},
+                      {{s1, {"b"}}, {s0, {"1"}}}},
+                     2);
+}
+
+}  // namespace automat_testing
@@ -0,0 +1,128 @@
+// canonical_automat.cpp
+#include "canonical_automat.hpp"
+#include <functional>
+#include <iterator>
+#include <map>
+#include <queue>
+
+namespace {
+
+std::size_t HashCombine(std::size_t seed, std::size_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+}  // namespace
+
+CanonicalAutomat Canonize(const Automat& automat) {
+  if (!automat.states.contains(automat.initial_state)) {
+    throw AutomatException("Initial state is not in states");
+  }
+
+  const std::vector<State> states(automat.states.begin(),
+                                  automat.states.end());
+  const std::size_t signal_count = automat.input_signals.size();
+  const auto index_of = [](const auto& set, const auto& value) {
+    auto it = set.find(value);
+    if (it == set.end()) {
+      throw AutomatException("Transition leads outside of the automat: " +
+                             value.id);
+    }
+    return static_cast<std::uint32_t>(std::distance(set.begin(), it));
+  };
+
+  // Таблица переходов по номерам состояний в порядке std::set
+  std::vector<std::vector<CanonicalAutomat::Transition>> table(states.size());
+  for (std::size_t state = 0; state < states.size(); ++state) {
+    table[state].reserve(signal_count);
+    for (const auto& signal : automat.input_signals) {
+      auto [next, out] = automat.transition_function({states[state], signal});
+      table[state].emplace_back(index_of(automat.states, next),
+                                index_of(automat.output_signals, out));
+    }
+  }
+
+  // Разбиение на классы эквивалентности: начинаем с классов по выходам
+  // и дробим по классам следующих состояний, пока число классов растёт
+  std::vector<std::uint32_t> block(states.size());
+  std::size_t block_count = 0;
+  while (true) {
+    std::map<std::vector<std::uint32_t>, std::uint32_t> signatures{};
+    std::vector<std::uint32_t> next_block(states.size());
+    for (std::size_t state = 0; state < states.size(); ++state) {
+      std::vector<std::uint32_t> signature{};
+      signature.reserve(2 * signal_count + 1);
+      if (block_count != 0) signature.push_back(block[state]);
+      for (const auto& [next, out] : table[state]) {
+        signature.push_back(out);
+        if (block_count != 0) signature.push_back(block[next]);
+      }
+      next_block[state] =
+          signatures.try_emplace(std::move(signature), signatures.size())
+              .first->second;
+    }
+    block = std::move(next_block);
+    if (signatures.size() == block_count) break;
+    block_count = signatures.size();
+  }
+
+  // Каноничная нумерация классов обходом в ширину из начального состояния
+  std::vector<std::uint32_t> representative(block_count);
+  for (std::size_t state = states.size(); state-- > 0;) {
+    representative[block[state]] = state;
+  }
+  constexpr auto kUnvisited = static_cast<std::uint32_t>(-1);
+  std::vector<std::uint32_t> canonical(block_count, kUnvisited);
+  std::vector<std::uint32_t> order{};
+  std::queue<std::uint32_t> queue;
+  const auto initial = block[index_of(automat.states, automat.initial_state)];
+  canonical[initial] = 0;
+  order.push_back(initial);
+  queue.push(initial);
+  while (!queue.empty()) {
+    const auto current = queue.front();
+    queue.pop();
+    for (const auto& [next, out] : table[representative[current]]) {
+      if (canonical[block[next]] == kUnvisited) {
+        canonical[block[next]] = order.size();
+        order.push_back(block[next]);
+        queue.push(block[next]);
+      }
+    }
+  }
+
+  CanonicalAutomat result{};
+  for (const auto& signal : automat.input_signals) {
+    result.input_signals.push_back(signal.id);
+  }
+  for (const auto& signal : automat.output_signals) {
+    result.output_signals.push_back(signal.id);
+  }
+  result.table.reserve(order.size());
+  for (const auto current : order) {
+    auto& row = result.table.emplace_back();
+    row.reserve(signal_count);
+    for (const auto& [next, out] : table[representative[current]]) {
+      row.emplace_back(canonical[block[next]], out);
+    }
+  }
+  return result;
+}
+
+std::size_t Fingerprint(const CanonicalAutomat& automat) {
+  std::size_t seed = 0;
+  for (const auto& signal : automat.input_signals) {
+    seed = HashCombine(seed, std::hash<std::string>{}(signal));
+  }
+  seed = HashCombine(seed, automat.input_signals.size());
+  for (const auto& signal : automat.output_signals) {
+    seed = HashCombine(seed, std::hash<std::string>{}(signal));
+  }
+  seed = HashCombine(seed, automat.output_signals.size());
+  for (const auto& row : automat.table) {
+    for (const auto& [next, out] : row) {
+      seed = HashCombine(seed, next);
+      seed = HashCombine(seed, out);
+    }
+  }
+  return seed;
+}
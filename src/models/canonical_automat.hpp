@@ -0,0 +1,33 @@
+// canonical_automat.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "automat.hpp"
+
+// Минимизированный автомат с каноничной нумерацией состояний: номера
+// выдаются обходом в ширину из начального состояния в порядке входных
+// сигналов. Эквивалентные автоматы с одинаковыми алфавитами имеют
+// одинаковую каноничную форму независимо от имён состояний.
+class CanonicalAutomat {
+ public:
+  // Пара (номер следующего состояния, номер выходного сигнала)
+  using Transition = std::pair<std::uint32_t, std::uint32_t>;
+
+  friend bool operator==(const CanonicalAutomat& lhs,
+                         const CanonicalAutomat& rhs) = default;
+
+  std::vector<std::string> input_signals;
+  std::vector<std::string> output_signals;
+  // table[state][signal], начальное состояние всегда имеет номер 0
+  std::vector<std::vector<Transition>> table;
+};
+
+CanonicalAutomat Canonize(const Automat& automat);
+
+// Хеш каноничной формы, совпадает у эквивалентных автоматов
+std::size_t Fingerprint(const CanonicalAutomat& automat);
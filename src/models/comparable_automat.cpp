@@ -0,0 +1,29 @@
+// comparable_automat.cpp
+#include "comparable_automat.hpp"
+
+ComparableAutomat::ComparableAutomat(Automat automat)
+    : automat{std::move(automat)},
+      tiny{MakeSmallAutomat<TinyAutomat>(this->automat)} {}
+
+const ProbeSignature* ComparableAutomat::Signature() const {
+  return signature_cache.Get([this] { return ComputeProbeSignature(automat); });
+}
+
+bool operator==(const ComparableAutomat& lhs, const ComparableAutomat& rhs) {
+  // При разных алфавитах общий алгоритм бросит исключение
+  const bool same_alphabets =
+      lhs.automat.input_signals == rhs.automat.input_signals &&
+      lhs.automat.output_signals == rhs.automat.output_signals;
+  if (same_alphabets && lhs.tiny && rhs.tiny) {
+    return *lhs.tiny == *rhs.tiny;
+  }
+  if (same_alphabets) {
+    // Разные выходы на пробных словах доказывают неэквивалентность
+    const ProbeSignature* lhs_signature = lhs.Signature();
+    const ProbeSignature* rhs_signature = rhs.Signature();
+    if (lhs_signature && rhs_signature && !(*lhs_signature == *rhs_signature)) {
+      return false;
+    }
+  }
+  return lhs.automat == rhs.automat;
+}
@@ -0,0 +1,34 @@
+// comparable_automat.hpp
+#pragma once
+
+#include <optional>
+
+#include "automat.hpp"
+#include "probe_signature.hpp"
+#include "small_automat.hpp"
+
+// Неизменяемый автомат с заранее подготовленными данными для сравнения.
+// Перевод в TinyAutomat выполняется один раз в конструкторе, поэтому
+// сравнение маленьких автоматов не вызывает transition_function и не
+// выделяет память. Для остальных автоматов лениво вычисляется сигнатура на
+// пробных словах, и неравные сигнатуры отсекают пару без построения
+// произведения. Automat закрыт от изменений, так что подготовленные данные
+// не могут устареть.
+class ComparableAutomat {
+ public:
+  ComparableAutomat() = default;
+  explicit ComparableAutomat(Automat automat);
+
+  const Automat& Source() const { return automat; }
+  const std::optional<TinyAutomat>& Tiny() const { return tiny; }
+  // nullptr, если сигнатура недоступна или ещё вычисляется другим потоком
+  const ProbeSignature* Signature() const;
+
+  friend bool operator==(const ComparableAutomat& lhs,
+                         const ComparableAutomat& rhs);
+
+ private:
+  Automat automat;
+  std::optional<TinyAutomat> tiny;
+  ProbeSignatureCache signature_cache;
+};
@@ -0,0 +1,60 @@
+// probe_signature.cpp
+#include "probe_signature.hpp"
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace {
+
+using ProbeWords =
+    std::array<std::array<std::uint32_t, ProbeSignature::kWordLength>,
+               ProbeSignature::kWords>;
+
+// Пробные слова одинаковы для всех автоматов: буква берётся по модулю
+// числа входных сигналов
+const ProbeWords& GetProbeWords() {
+  static const ProbeWords kProbeWords = [] {
+    std::mt19937 generator(ProbeSignature::kSeed);
+    ProbeWords words{};
+    for (auto& word : words) {
+      for (auto& letter : word) letter = generator();
+    }
+    return words;
+  }();
+  return kProbeWords;
+}
+
+}  // namespace
+
+std::optional<ProbeSignature> ComputeProbeSignature(const Automat& automat) {
+  if (!automat.transition_function || automat.input_signals.empty() ||
+      automat.output_signals.empty()) {
+    return std::nullopt;
+  }
+  // Ширина кода - степень двойки, чтобы код не пересекал границу uint64_t
+  const std::size_t width = std::bit_ceil(std::max<std::size_t>(
+      std::bit_width(automat.output_signals.size() - 1), 1));
+  if (width > ProbeSignature::kMaxOutputBits) return std::nullopt;
+
+  const std::vector<Signal> inputs(automat.input_signals.begin(),
+                                   automat.input_signals.end());
+  ProbeSignature result{};
+  std::size_t position = 0;
+  for (const auto& word : GetProbeWords()) {
+    State state = automat.initial_state;
+    for (const auto letter : word) {
+      auto [next, out] =
+          automat.transition_function({state, inputs[letter % inputs.size()]});
+      auto out_it = automat.output_signals.find(out);
+      if (out_it == automat.output_signals.end()) return std::nullopt;
+      const std::uint64_t code =
+          std::distance(automat.output_signals.begin(), out_it);
+      result.bits[position / 64] |= code << (position % 64);
+      position += width;
+      state = std::move(next);
+    }
+  }
+  return result;
+}
@@ -0,0 +1,81 @@
+// probe_signature.hpp
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "automat.hpp"
+
+// Выходные слова автомата на фиксированном наборе пробных входных слов,
+// упакованные в битовый вектор. У эквивалентных автоматов с одинаковыми
+// алфавитами сигнатуры совпадают, поэтому несовпадение сигнатур сразу
+// доказывает неэквивалентность.
+struct ProbeSignature {
+  static constexpr std::size_t kWords = 16;
+  static constexpr std::size_t kWordLength = 8;
+  static constexpr std::uint32_t kSeed = 0x5eed;
+  // Выходной сигнал кодируется номером не шире kMaxOutputBits бит
+  static constexpr std::size_t kMaxOutputBits = 4;
+
+  friend bool operator==(const ProbeSignature& lhs,
+                         const ProbeSignature& rhs) = default;
+
+  std::array<std::uint64_t, kWords * kWordLength * kMaxOutputBits / 64> bits{};
+};
+
+// Лениво вычисляемая сигнатура. Первый поток, дошедший до Get, вычисляет и
+// сохраняет её, остальные до окончания вычисления получают nullptr и
+// обходятся без быстрой проверки. Копия сохраняет только готовую сигнатуру.
+class ProbeSignatureCache {
+ public:
+  ProbeSignatureCache() = default;
+  ProbeSignatureCache(const ProbeSignatureCache& other) { *this = other; }
+  ProbeSignatureCache& operator=(const ProbeSignatureCache& other) {
+    // Пока статус не kReady, другой поток может писать value внутри Get
+    if (other.status.load(std::memory_order_acquire) == Status::kReady) {
+      value = other.value;
+      status.store(Status::kReady, std::memory_order_release);
+    } else {
+      status.store(Status::kEmpty, std::memory_order_release);
+    }
+    return *this;
+  }
+
+  template <typename Compute>
+  const ProbeSignature* Get(Compute compute) const {
+    auto current = status.load(std::memory_order_acquire);
+    if (current == Status::kReady) return &value;
+    if (current != Status::kEmpty ||
+        !status.compare_exchange_strong(current, Status::kComputing,
+                                        std::memory_order_acquire)) {
+      return nullptr;
+    }
+    std::optional<ProbeSignature> computed;
+    try {
+      computed = compute();
+    } catch (...) {
+      // Иначе статус навсегда останется kComputing
+      status.store(Status::kEmpty, std::memory_order_release);
+      throw;
+    }
+    if (!computed) {
+      status.store(Status::kUnavailable, std::memory_order_release);
+      return nullptr;
+    }
+    value = *computed;
+    status.store(Status::kReady, std::memory_order_release);
+    return &value;
+  }
+
+ private:
+  enum class Status : std::uint8_t { kEmpty, kComputing, kReady, kUnavailable };
+
+  mutable std::atomic<Status> status{Status::kEmpty};
+  mutable ProbeSignature value{};
+};
+
+// Сигнатура автомата, std::nullopt, если его выходы не удаётся закодировать
+std::optional<ProbeSignature> ComputeProbeSignature(const Automat& automat);
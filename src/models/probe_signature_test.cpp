@@ -0,0 +1,128 @@
+#include "automat_test_utils.hpp"
+#include "comparable_automat.hpp"
+#include "probe_signature.hpp"
+#include <map>
+#include <memory>
+
+#include <userver/utest/utest.hpp>
+
+namespace {
+
+using automat_testing::MakeAutomat;
+
+// Выдаёт 1 только на вход b во втором состоянии
+Automat MakeTwoState(const std::string& prefix, const Signal& late_output) {
+  const State s0{prefix + "0"}, s1{prefix + "1"};
+  return MakeAutomat(prefix,
+                     {{{s0, {"a"}}, {s1, {"0"}}},
+                      {{s0, {"b"}}, {s0, {"0"}}},
+                      {{s1, {"a"}}, {s1, {"0"}}},
+                      {{s1, {"b"}}, {s0, late_output}}},
+                     2);
+}
+
+// Цикл из 9 состояний, слишком большой для TinyAutomat. Любой вход
+// переводит в следующее состояние, в состоянии 3 выдаётся late_output.
+// calls считает вызовы transition_function.
+Automat MakeCountedCycle(const std::string& prefix, const Signal& late_output,
+                         std::shared_ptr<int> calls) {
+  constexpr uint32_t kCount = 9;
+  std::map<ControlPair, ControlPair> table{};
+  for (uint32_t i = 0; i < kCount; ++i) {
+    const State next{prefix + std::to_string((i + 1) % kCount)};
+    const Signal out = i == 3 ? late_output : Signal("0");
+    for (const auto& signal : {Signal("a"), Signal("b")}) {
+      table[{State(prefix + std::to_string(i)), signal}] = {next, out};
+    }
+  }
+  Automat result = MakeAutomat(prefix, table, kCount);
+  result.transition_function = [inner = result.transition_function,
+                                calls](ControlPair in) {
+    ++*calls;
+    return inner(in);
+  };
+  return result;
+}
+
+}  // namespace
+
+UTEST(ProbeSignature, EqualAutomats) {
+  auto lhs = ComputeProbeSignature(MakeTwoState("q", {"1"}));
+  auto rhs = ComputeProbeSignature(MakeTwoState("S", {"1"}));
+  ASSERT_TRUE(lhs.has_value());
+  ASSERT_TRUE(rhs.has_value());
+  EXPECT_EQ(*lhs, *rhs);
+}
+
+UTEST(ProbeSignature, UnequalAutomats) {
+  auto lhs = ComputeProbeSignature(MakeTwoState("q", {"1"}));
+  auto rhs = ComputeProbeSignature(MakeTwoState("S", {"0"}));
+  ASSERT_TRUE(lhs.has_value());
+  ASSERT_TRUE(rhs.has_value());
+  EXPECT_FALSE(*lhs == *rhs);
+}
+
+UTEST(ProbeSignature, Unavailable) {
+  EXPECT_FALSE(ComputeProbeSignature(Automat()).has_value());
+  EXPECT_EQ(ComparableAutomat().Signature(), nullptr);
+}
+
+UTEST(ProbeSignature, CachedAndCopied) {
+  auto calls = std::make_shared<int>(0);
+  const ComparableAutomat automat{MakeCountedCycle("q", {"1"}, calls)};
+  const ProbeSignature* signature = automat.Signature();
+  ASSERT_NE(signature, nullptr);
+  const int computed_calls = *calls;
+  EXPECT_GT(computed_calls, 0);
+  EXPECT_EQ(automat.Signature(), signature);
+
+  const ComparableAutomat copy = automat;
+  ASSERT_NE(copy.Signature(), nullptr);
+  EXPECT_EQ(*copy.Signature(), *signature);
+  EXPECT_EQ(*calls, computed_calls);
+}
+
+UTEST(ProbeSignature, RejectsWithoutExactCheck) {
+  auto calls = std::make_shared<int>(0);
+  const ComparableAutomat lhs{MakeCountedCycle("q", {"1"}, calls)};
+  const ComparableAutomat rhs{MakeCountedCycle("S", {"0"}, calls)};
+  ASSERT_FALSE(lhs.Tiny().has_value());
+  EXPECT_FALSE(lhs == rhs);
+
+  // Сигнатуры уже посчитаны, точная проверка вызвала бы transition_function
+  *calls = 0;
+  EXPECT_FALSE(lhs == rhs);
+  EXPECT_EQ(*calls, 0);
+}
+
+UTEST(ProbeSignature, EqualRunsExactCheck) {
+  auto calls = std::make_shared<int>(0);
+  const ComparableAutomat lhs{MakeCountedCycle("q", {"1"}, calls)};
+  const ComparableAutomat rhs{MakeCountedCycle("S", {"1"}, calls)};
+  EXPECT_TRUE(lhs == rhs);
+
+  *calls = 0;
+  EXPECT_TRUE(lhs == rhs);
+  EXPECT_GT(*calls, 0);
+}
+
+UTEST(ProbeSignature, UnequalAlphabetsStillThrow) {
+  auto calls = std::make_shared<int>(0);
+  Automat other = MakeCountedCycle("S", {"0"}, calls);
+  other.output_signals.insert({"2"});
+  const ComparableAutomat lhs{MakeCountedCycle("q", {"1"}, calls)};
+  const ComparableAutomat rhs{std::move(other)};
+  EXPECT_THROW(static_cast<void>(lhs == rhs), AutomatException);
+}
+
+UTEST(ProbeSignature, ThrowingCompute) {
+  ProbeSignatureCache cache;
+  const auto throwing = []() -> std::optional<ProbeSignature> {
+    throw AutomatException("broken transition function");
+  };
+  EXPECT_THROW(cache.Get(throwing), AutomatException);
+  const ProbeSignature* signature =
+      cache.Get([] { return std::optional<ProbeSignature>{ProbeSignature{}}; });
+  ASSERT_NE(signature, nullptr);
+  EXPECT_EQ(*signature, ProbeSignature{});
+}
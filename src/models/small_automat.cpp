@@ -0,0 +1,15 @@
+// small_automat.cpp
+#include "small_automat.hpp"
+
+std::optional<bool> CompareSmall(const Automat& lhs, const Automat& rhs) {
+  // Несовпадающие алфавиты оставляем общему алгоритму, он бросит исключение
+  if (lhs.input_signals != rhs.input_signals ||
+      lhs.output_signals != rhs.output_signals) {
+    return std::nullopt;
+  }
+  auto small_lhs = MakeSmallAutomat<TinyAutomat>(lhs);
+  if (!small_lhs) return std::nullopt;
+  auto small_rhs = MakeSmallAutomat<TinyAutomat>(rhs);
+  if (!small_rhs) return std::nullopt;
+  return *small_lhs == *small_rhs;
+}
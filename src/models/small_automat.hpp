@@ -0,0 +1,217 @@
+// small_automat.hpp
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <set>
+
+#include "automat.hpp"
+
+// Автомат фиксированного размера: таблица переходов лежит в std::array,
+// множества состояний хранятся битовыми масками. Используется для маленьких
+// автоматов, для которых Automat с std::set и std::function слишком дорог.
+// Reachable и Trim работают до 64 состояний, произведение и сравнение
+// обходят пары состояний, поэтому требуют kMaxStates * kMaxStates <= 64.
+template <std::size_t kMaxStates, std::size_t kMaxSignals>
+class SmallAutomat {
+  static_assert(kMaxStates > 0 && kMaxStates <= 64,
+                "State set must fit into a 64-bit mask");
+  static_assert(kMaxSignals > 0 && kMaxSignals <= 255,
+                "Signal count must fit into uint8_t");
+
+ public:
+  using StateSet = std::uint64_t;
+  using Index = std::uint8_t;
+
+  static constexpr std::size_t kStates = kMaxStates;
+  static constexpr std::size_t kSignals = kMaxSignals;
+
+  static constexpr StateSet Bit(std::size_t state) {
+    return StateSet{1} << state;
+  }
+
+  // Битовая маска состояний, достижимых из начального
+  StateSet Reachable() const {
+    StateSet visited = Bit(initial_state);
+    StateSet frontier = visited;
+    while (frontier != 0) {
+      const auto state = static_cast<std::size_t>(std::countr_zero(frontier));
+      frontier &= frontier - 1;
+      for (std::size_t signal = 0; signal < input_count; ++signal) {
+        const StateSet next = Bit(next_state[state][signal]);
+        if ((visited & next) == 0) {
+          visited |= next;
+          frontier |= next;
+        }
+      }
+    }
+    return visited;
+  }
+
+  // Оставляет только достижимые состояния, сохраняя их относительный порядок
+  SmallAutomat Trim() const {
+    const StateSet reachable = Reachable();
+    std::array<Index, kMaxStates> renumber{};
+    Index count = 0;
+    for (std::size_t state = 0; state < state_count; ++state) {
+      if (reachable & Bit(state)) renumber[state] = count++;
+    }
+
+    SmallAutomat result{};
+    result.state_count = count;
+    result.input_count = input_count;
+    result.output_count = output_count;
+    result.initial_state = renumber[initial_state];
+    for (std::size_t state = 0; state < state_count; ++state) {
+      if ((reachable & Bit(state)) == 0) continue;
+      for (std::size_t signal = 0; signal < input_count; ++signal) {
+        result.next_state[renumber[state]][signal] =
+            renumber[next_state[state][signal]];
+        result.output[renumber[state]][signal] = output[state][signal];
+      }
+    }
+    return result;
+  }
+
+  // Выходной сигнал произведения кодирует пару lhs * output_count + rhs,
+  // стабилен он тогда и только тогда, когда обе компоненты совпадают
+  bool IsStable(std::size_t signal) const {
+    return signal % (product_base + 1) == 0;
+  }
+
+  Index state_count = 0;
+  Index input_count = 0;
+  Index output_count = 0;
+  Index initial_state = 0;
+  // Для произведения: число выходных сигналов сомножителей, иначе 0
+  Index product_base = 0;
+  std::array<std::array<Index, kMaxSignals>, kMaxStates> next_state{};
+  std::array<std::array<Index, kMaxSignals>, kMaxStates> output{};
+};
+
+// Произведение автоматов, состояние (a, b) имеет номер a * kMaxStates + b
+template <std::size_t kMaxStates, std::size_t kMaxSignals>
+SmallAutomat<kMaxStates * kMaxStates, kMaxSignals> operator*(
+    const SmallAutomat<kMaxStates, kMaxSignals>& lhs,
+    const SmallAutomat<kMaxStates, kMaxSignals>& rhs) {
+  static_assert(kMaxStates * kMaxStates <= 64,
+                "Product state set must fit into a 64-bit mask");
+  // Код пары выходов и их число должны помещаться в uint8_t
+  static_assert(kMaxSignals * kMaxSignals <= 255,
+                "Product output signals must fit into uint8_t");
+  if (lhs.input_count != rhs.input_count) {
+    throw AutomatException("Input signals are unequal");
+  }
+  if (lhs.output_count != rhs.output_count) {
+    throw AutomatException("Output signals are unequal");
+  }
+
+  SmallAutomat<kMaxStates * kMaxStates, kMaxSignals> result{};
+  result.state_count = kMaxStates * kMaxStates;
+  result.input_count = lhs.input_count;
+  result.output_count = lhs.output_count * lhs.output_count;
+  result.product_base = lhs.output_count;
+  result.initial_state = lhs.initial_state * kMaxStates + rhs.initial_state;
+  for (std::size_t a = 0; a < lhs.state_count; ++a) {
+    for (std::size_t b = 0; b < rhs.state_count; ++b) {
+      for (std::size_t signal = 0; signal < lhs.input_count; ++signal) {
+        result.next_state[a * kMaxStates + b][signal] =
+            lhs.next_state[a][signal] * kMaxStates + rhs.next_state[b][signal];
+        result.output[a * kMaxStates + b][signal] =
+            lhs.output[a][signal] * lhs.output_count + rhs.output[b][signal];
+      }
+    }
+  }
+  return result;
+}
+
+// Эквивалентность: обход произведения без его построения, как только
+// встречается пара разных выходных сигналов, автоматы неэквивалентны
+template <std::size_t kMaxStates, std::size_t kMaxSignals>
+bool operator==(const SmallAutomat<kMaxStates, kMaxSignals>& lhs,
+                const SmallAutomat<kMaxStates, kMaxSignals>& rhs) {
+  static_assert(kMaxStates * kMaxStates <= 64,
+                "Product state set must fit into a 64-bit mask");
+  if (lhs.input_count != rhs.input_count) {
+    throw AutomatException("Input signals are unequal");
+  }
+  if (lhs.output_count != rhs.output_count) {
+    throw AutomatException("Output signals are unequal");
+  }
+
+  using StateSet = std::uint64_t;
+  const std::size_t initial =
+      lhs.initial_state * kMaxStates + rhs.initial_state;
+  StateSet visited = StateSet{1} << initial;
+  StateSet frontier = visited;
+  while (frontier != 0) {
+    const auto pair = static_cast<std::size_t>(std::countr_zero(frontier));
+    frontier &= frontier - 1;
+    const std::size_t a = pair / kMaxStates;
+    const std::size_t b = pair % kMaxStates;
+    for (std::size_t signal = 0; signal < lhs.input_count; ++signal) {
+      if (lhs.output[a][signal] != rhs.output[b][signal]) return false;
+      const StateSet next =
+          StateSet{1} << (lhs.next_state[a][signal] * kMaxStates +
+                          rhs.next_state[b][signal]);
+      if ((visited & next) == 0) {
+        visited |= next;
+        frontier |= next;
+      }
+    }
+  }
+  return true;
+}
+
+// Переводит Automat в таблицу фиксированного размера. Сигналы и состояния
+// нумеруются в порядке std::set, поэтому автоматы с одинаковыми алфавитами
+// получают одинаковую нумерацию. Возвращает std::nullopt, если автомат
+// не помещается в шаблон или переходит в состояние вне states.
+template <typename Small>
+std::optional<Small> MakeSmallAutomat(const Automat& automat) {
+  if (automat.states.size() > Small::kStates ||
+      automat.input_signals.size() > Small::kSignals ||
+      automat.output_signals.size() > Small::kSignals) {
+    return std::nullopt;
+  }
+  if (!automat.states.contains(automat.initial_state)) return std::nullopt;
+
+  Small result{};
+  result.state_count = automat.states.size();
+  result.input_count = automat.input_signals.size();
+  result.output_count = automat.output_signals.size();
+  result.initial_state = std::distance(
+      automat.states.begin(), automat.states.find(automat.initial_state));
+
+  std::size_t state_index = 0;
+  for (const auto& state : automat.states) {
+    std::size_t signal_index = 0;
+    for (const auto& signal : automat.input_signals) {
+      auto [next, out] = automat.transition_function({state, signal});
+      auto next_it = automat.states.find(next);
+      auto out_it = automat.output_signals.find(out);
+      if (next_it == automat.states.end() ||
+          out_it == automat.output_signals.end()) {
+        return std::nullopt;
+      }
+      result.next_state[state_index][signal_index] =
+          std::distance(automat.states.begin(), next_it);
+      result.output[state_index][signal_index] =
+          std::distance(automat.output_signals.begin(), out_it);
+      ++signal_index;
+    }
+    ++state_index;
+  }
+  return result;
+}
+
+// Автоматы, которые выдаёт генератор, помещаются сюда с запасом
+using TinyAutomat = SmallAutomat<8, 8>;
+
+// Сравнивает автоматы через SmallAutomat, если оба в него помещаются.
+// std::nullopt означает, что нужно использовать общий алгоритм.
+std::optional<bool> CompareSmall(const Automat& lhs, const Automat& rhs);
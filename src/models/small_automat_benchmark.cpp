@@ -0,0 +1,45 @@
+#include "automat_test_utils.hpp"
+#include "comparable_automat.hpp"
+#include "small_automat.hpp"
+
+#include <benchmark/benchmark.h>
+
+using automat_testing::MakeToggle;
+
+void SmallAutomatCompare(benchmark::State& state) {
+  const auto lhs = *MakeSmallAutomat<TinyAutomat>(MakeToggle("q"));
+  const auto rhs = *MakeSmallAutomat<TinyAutomat>(MakeToggle("S"));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+}
+BENCHMARK(SmallAutomatCompare);
+
+void AutomatCompare(benchmark::State& state) {
+  const auto lhs = MakeToggle("q");
+  const auto rhs = MakeToggle("S");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+}
+BENCHMARK(AutomatCompare);
+
+// Путь диспетчера по Automat: каждый вызов заново переводит оба автомата
+void CompareSmallDispatch(benchmark::State& state) {
+  const auto lhs = MakeToggle("q");
+  const auto rhs = MakeToggle("S");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CompareSmall(lhs, rhs));
+  }
+}
+BENCHMARK(CompareSmallDispatch);
+
+// Путь диспетчера по ComparableAutomat: перевод сделан при создании
+void ComparableAutomatCompare(benchmark::State& state) {
+  const ComparableAutomat lhs{MakeToggle("q")};
+  const ComparableAutomat rhs{MakeToggle("S")};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+}
+BENCHMARK(ComparableAutomatCompare);
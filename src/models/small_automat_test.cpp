@@ -0,0 +1,109 @@
+#include "automat_test_utils.hpp"
+#include "comparable_automat.hpp"
+#include "small_automat.hpp"
+#include <map>
+
+#include <userver/utest/utest.hpp>
+
+namespace {
+
+using automat_testing::MakeAutomat;
+using automat_testing::MakeToggle;
+
+// Тот же автомат с лишним состоянием S2, дублирующим S0
+Automat MakeRedundantToggle(const std::string& prefix) {
+  const State s0{prefix + "0"}, s1{prefix + "1"}, s2{prefix + "2"};
+  return MakeAutomat(prefix,
+                     {{{s0, {"a"}}, {s1, {"0"}}},
+                      {{s0, {"b"}}, {s1, {"0"}}},
+                      {{s1, {"a"}}, {s2, {"1"}}},
+                      {{s1, {"b"}}, {s0, {"1"}}},
+                      {{s2, {"a"}}, {s1, {"0"}}},
+                      {{s2, {"b"}}, {s1, {"0"}}}},
+                     3);
+}
+
+}  // namespace
+
+UTEST(SmallAutomat, Convert) {
+  auto small = MakeSmallAutomat<TinyAutomat>(MakeToggle("q"));
+  ASSERT_TRUE(small.has_value());
+  EXPECT_EQ(small->state_count, 2);
+  EXPECT_EQ(small->input_count, 2);
+  EXPECT_EQ(small->output_count, 2);
+  EXPECT_EQ(small->initial_state, 0);
+  EXPECT_EQ(small->next_state[0][0], 1);
+  EXPECT_EQ(small->output[1][1], 1);
+}
+
+UTEST(SmallAutomat, TooBig) {
+  std::map<ControlPair, ControlPair> table{};
+  for (uint32_t i = 0; i < 9; ++i) {
+    for (const auto& signal : {Signal("a"), Signal("b")}) {
+      table[{State("q" + std::to_string(i)), signal}] = {State("q0"),
+                                                         Signal("0")};
+    }
+  }
+  EXPECT_FALSE(
+      MakeSmallAutomat<TinyAutomat>(MakeAutomat("q", table, 9)).has_value());
+}
+
+UTEST(SmallAutomat, Trim) {
+  auto small = MakeSmallAutomat<TinyAutomat>(MakeRedundantToggle("q"));
+  ASSERT_TRUE(small.has_value());
+  auto product = *small * *small;
+  EXPECT_EQ(std::popcount(product.Reachable()), 3);
+  auto trimmed = product.Trim();
+  EXPECT_EQ(trimmed.state_count, 3);
+  for (std::size_t state = 0; state < trimmed.state_count; ++state) {
+    for (std::size_t signal = 0; signal < trimmed.input_count; ++signal) {
+      EXPECT_TRUE(trimmed.IsStable(trimmed.output[state][signal]));
+    }
+  }
+}
+
+UTEST(SmallAutomat, Equal) {
+  auto lhs = MakeSmallAutomat<TinyAutomat>(MakeToggle("q"));
+  auto rhs = MakeSmallAutomat<TinyAutomat>(MakeRedundantToggle("S"));
+  ASSERT_TRUE(lhs.has_value());
+  ASSERT_TRUE(rhs.has_value());
+  EXPECT_TRUE(*lhs == *rhs);
+  EXPECT_TRUE(MakeToggle("q") == MakeRedundantToggle("S"));
+}
+
+UTEST(SmallAutomat, Unequal) {
+  const State s0{"S0"}, s1{"S1"};
+  Automat other = MakeAutomat("S",
+                              {{{s0, {"a"}}, {s1, {"0"}}},
+                               {{s0, {"b"}}, {s1, {"0"}}},
+                               {{s1, {"a"}}, {s0, {"1"}}},
+                               {{s1, {"b"}}, {s0, {"0"}}}},
+                              2);
+  auto lhs = MakeSmallAutomat<TinyAutomat>(MakeToggle("q"));
+  auto rhs = MakeSmallAutomat<TinyAutomat>(other);
+  ASSERT_TRUE(lhs.has_value());
+  ASSERT_TRUE(rhs.has_value());
+  EXPECT_FALSE(*lhs == *rhs);
+  EXPECT_FALSE(MakeToggle("q") == other);
+}
+
+UTEST(ComparableAutomat, Dispatch) {
+  const ComparableAutomat toggle{MakeToggle("q")};
+  const ComparableAutomat redundant{MakeRedundantToggle("S")};
+  ASSERT_TRUE(toggle.Tiny().has_value());
+  ASSERT_TRUE(redundant.Tiny().has_value());
+  EXPECT_TRUE(toggle == redundant);
+
+  // Переключатель q0 <-> q1 с семью недостижимыми состояниями
+  std::map<ControlPair, ControlPair> table{};
+  for (uint32_t i = 0; i < 9; ++i) {
+    const State next{i == 0 ? "q1" : "q0"};
+    const Signal out{i == 0 ? "0" : "1"};
+    for (const auto& signal : {Signal("a"), Signal("b")}) {
+      table[{State("q" + std::to_string(i)), signal}] = {next, out};
+    }
+  }
+  const ComparableAutomat big{MakeAutomat("q", table, 9)};
+  EXPECT_FALSE(big.Tiny().has_value());
+  EXPECT_TRUE(big == toggle);
+}
@@ -0,0 +1,80 @@
+import json
+
+
+def make_toggle(prefix):
+    s0, s1 = prefix + '0', prefix + '1'
+    return {
+        'initial_state': s0,
+        'state': [s0, s1],
+        'input_signals': ['a', 'b'],
+        'output_signals': ['0', '1'],
+        'transition_function': {
+            s0: {
+                'a': {'state': s1, 'signal': '0'},
+                'b': {'state': s1, 'signal': '0'},
+            },
+            s1: {
+                'a': {'state': s0, 'signal': '1'},
+                'b': {'state': s0, 'signal': '1'},
+            },
+        },
+    }
+
+
+def make_constant(prefix):
+    s0 = prefix + '0'
+    return {
+        'initial_state': s0,
+        'state': [s0],
+        'input_signals': ['a', 'b'],
+        'output_signals': ['0', '1'],
+        'transition_function': {
+            s0: {
+                'a': {'state': s0, 'signal': '0'},
+                'b': {'state': s0, 'signal': '0'},
+            },
+        },
+    }
+
+
+async def find(service_client, automat):
+    response = await service_client.post('/library', json=automat)
+    assert response.status == 200
+    return sorted(json.loads(response.text)['ids'])
+
+
+async def test_library(service_client):
+    response = await service_client.put(
+        '/library', params={'id': 'toggle'}, json=make_toggle('q'),
+    )
+    assert response.status == 200
+    response = await service_client.put(
+        '/library', params={'id': 'constant'}, json=make_constant('c'),
+    )
+    assert response.status == 200
+
+    assert await find(service_client, make_toggle('S')) == ['toggle']
+    assert await find(service_client, make_constant('S')) == ['constant']
+
+    response = await service_client.delete(
+        '/library', params={'id': 'toggle'},
+    )
+    assert response.status == 200
+    assert await find(service_client, make_toggle('S')) == []
+
+    response = await service_client.delete(
+        '/library', params={'id': 'toggle'},
+    )
+    assert response.status == 404
+
+    await service_client.delete('/library', params={'id': 'constant'})
+
+
+async def test_library_bad_request(service_client):
+    response = await service_client.put('/library', json=make_toggle('q'))
+    assert response.status == 400
+
+    broken = make_toggle('q')
+    broken['transition_function']['q0']['a']['state'] = 'q7'
+    response = await service_client.post('/library', json=broken)
+    assert response.status == 400